@@ -33,6 +33,7 @@
 #include <BRAY/BRAY_Interface.h>
 #include <HUSD/XUSD_HydraRenderBuffer.h>
 #include <SYS/SYS_AtomicInt.h>
+#include <UT/UT_Lock.h>
 #include <UT/UT_UniquePtr.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -71,22 +72,37 @@ public:
     void                UnmapExtra(int idx) override final;
     const UT_Options    &GetMetadata() const override final;
 
+    /// Karma doesn't report bucket writes, so every tile is dirty while the
+    /// render is in progress (and on the first poll after convergence, since
+    /// the final samples may land after the previous poll).  Once converged,
+    /// no tiles are reported until the raster, the AOV or the render changes.
+    exint		DirtyTiles(exint since,
+				UT_Array<UT_DimRect> &tiles) override final;
+
+    /// Size (in pixels) of the square tiles reported by DirtyTiles()
+    static constexpr int	theTileSize = 64;
+
     bool		isValid() const { return myAOVBuffer.isValid(); }
     const BRAY::AOVBufferPtr	&aovBuffer() const { return myAOVBuffer; }
-    void		setAOVBuffer(const BRAY::AOVBufferPtr &aov)
-    {
-	myAOVBuffer = aov;
-    }
+    void		setAOVBuffer(const BRAY::AOVBufferPtr &aov);
 
 private:
     void                _Deallocate() override final;
+    void		clearTiles();
 
     BRAY::AOVBufferPtr		myAOVBuffer;
     UT_UniquePtr<uint8_t[]>	myTempbuf;
+    exint			myTempbufSize;
+    UT_Lock			myTileLock;
+    exint			myGeneration;
+    exint			myTileGen;
+    int				myTileXres, myTileYres;
+    bool			myTileConverged;
     SYS_AtomicInt32		myConverged;
     int				myWidth, myHeight;
     HdFormat			myFormat;
     bool			myMultiSampled;
+    bool			myTempMapped;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -29,8 +29,9 @@
 
 #include <mutex>
 #include <GT/GT_Primitive.h>
+#include <UT/UT_ConcurrentHashMap.h>
 #include <UT/UT_Lock.h>
-#include <UT/UT_Map.h>
+#include <SYS/SYS_AtomicInt.h>
 #include <BRAY/BRAY_Interface.h>
 #include <HUSD/XUSD_HydraInstancer.h>
 
@@ -96,7 +97,15 @@ public:
     /// Returns nested level. For example, if this instancer does not have
     /// parent (ie root level) it will return 0. Also, if BRAY::Scene does not
     /// support nested instancing it will return 0.
-    int		getNestLevel() const { return myNestLevel; }
+    ///
+    /// The level is cached when this instancer is processed, and recomputed
+    /// when the instancer is dirtied.  If a parent isn't in the render index
+    /// yet, the partial level is returned but not cached.
+    int		getNestLevel() const
+		{
+		    int	level = myNestLevel.relaxedLoad();
+		    return level >= 0 ? level : -1 - level;
+		}
 
 private:
     // Return the attributes for the given prototype
@@ -111,7 +120,26 @@ private:
     // if the ids are contiguous.
     UT_Array<exint>	instanceIdsForPrototype(const SdfPath &protoId);
 
-    BRAY::ObjectPtr	&findOrCreate(const SdfPath &path);
+    struct PathHashCmp
+    {
+	static size_t	hash(const SdfPath &path)
+			    { return SdfPath::Hash()(path); }
+	static bool	equal(const SdfPath &a, const SdfPath &b)
+			    { return a == b; }
+    };
+    using InstanceMap = UT_ConcurrentHashMap<SdfPath,
+					     BRAY::ObjectPtr,
+					     PathHashCmp>;
+
+    // Find the instance object for the prototype.  If this is a new entry in
+    // the map, the object will be null and should be initialized by the
+    // caller.  The accessor holds a lock on the entry (and only that entry)
+    // until it goes out of scope.
+    BRAY::ObjectPtr	&findOrCreate(InstanceMap::accessor &acc,
+				      const SdfPath &path);
+
+    // Compute the nesting level (if required)
+    void		updateNestLevel();
 
     void	applyNestedInstance(BRAY::ScenePtr &scene,
 			SdfPath const &prototypeId,
@@ -119,11 +147,17 @@ private:
 			const UT_Array<GfMatrix4d> &protoXform);
 
 
-    UT_Map<SdfPath, BRAY::ObjectPtr>	myInstanceMap;
+    InstanceMap				myInstanceMap;
     BRAY::ObjectPtr			mySceneGraph;
     GT_AttributeListHandle		myAttributes;
-    int					myNestLevel;
-    bool				myNewObject;
+    VtValue				myVelocities;
+    VtValue				myAccelerations;
+    // The cached nesting level.  Negative values aren't cached, and
+    // store -1 minus the partial level found so far.
+    SYS_AtomicInt32			myNestLevel;
+    // Set when a new instance object is created, possibly by several
+    // prototypes syncing in parallel.
+    SYS_AtomicInt32			myNewObject;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
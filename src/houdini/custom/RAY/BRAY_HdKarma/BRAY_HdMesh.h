@@ -31,6 +31,8 @@
 #include <pxr/base/gf/matrix4f.h>
 
 #include <BRAY/BRAY_Interface.h>
+#include <GT/GT_Handles.h>
+#include <UT/UT_Array.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -73,6 +75,10 @@ private:
     BRAY::ObjectPtr		myInstance;
     BRAY::ObjectPtr		myMesh;
     UT_Array<GfMatrix4d>	myXform;
+    // Geometry subsets from the last topology update, so that material
+    // changes don't need to pull the topology again.
+    UT_Array<GT_DataArrayHandle>	mySubsetIndices;
+    UT_Array<SdfPath>		mySubsetMaterials;
     int8			myRefineLevel;
     bool			myComputeN;
     bool			myLeftHanded;
@@ -29,6 +29,7 @@
 #include <pxr/imaging/hd/renderDelegate.h>
 #include <pxr/imaging/hd/renderThread.h>
 #include <SYS/SYS_AtomicInt.h>
+#include <GT/GT_DataArray.h>
 #include <UT/UT_Set.h>
 #include <UT/UT_Lock.h>
 #include <UT/UT_Map.h>
@@ -78,6 +79,12 @@ public:
     bool	eraseLightCategory(const UT_StringHolder &name);
     bool	isValidLightCategory(const UT_StringHolder &name);
 
+    /// Return an array with the same contents as the given topology array
+    /// (face counts, vertex indices, etc.), shared by all the prims with the
+    /// same topology.  Scenes built from duplicated (rather than instanced)
+    /// assets then only store each unique topology once.
+    GT_DataArrayHandle	sharedTopology(const GT_DataArrayHandle &array);
+
     void	dump() const;
     void	dump(UT_JSONWriter &w) const;
 
@@ -177,6 +184,19 @@ private:
     bool                         myInstantShutter;
 
     UT_Set<UT_StringHolder>      myLightCategories;
+
+    // Topology arrays keyed by the hash of their contents.  The registry is
+    // split into shards by hash, each with its own lock, so meshes syncing
+    // in parallel rarely wait on each other.
+    static constexpr int	 theTopologyShardCount = 16;
+    struct TopologyShard
+    {
+	UT_Map<SYS_HashType, UT_Array<GT_DataArrayHandle>>	myArrays;
+	exint			 myCount = 0;
+	exint			 myPruneCount = 0;
+	UT_Lock			 myLock;
+    };
+    TopologyShard		 myTopology[theTopologyShardCount];
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
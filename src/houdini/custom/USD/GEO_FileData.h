@@ -19,12 +19,15 @@
 
 #include "GEO_SceneDescriptionData.h"
 #include "GEO_FilePrim.h"
+#include "GEO_FileRefiner.h"
 #include <GU/GU_DetailHandle.h>
 #include <UT/UT_UniquePtr.h>
 #include <UT/UT_Array.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+class GEO_ImportOptions;
+
 TF_DECLARE_WEAK_AND_REF_PTRS(GEO_FileData);
 
 /// \class GEO_FileData
@@ -50,6 +53,17 @@ protected:
                         ~GEO_FileData() override;
 
 private:
+    /// Converts the refined primitives to GEO_FilePrims using multiple
+    /// threads, producing the same result as a serial conversion.
+    void				 initGTPrimsThreaded(
+	const GEO_FileRefiner::GEO_FileGprimArray &prims,
+	const std::string &file_path,
+	const GEO_ImportOptions &options);
+
+    /// When property values are converted from the source geometry on
+    /// demand, hold onto all the geometry referenced by the refined prims.
+    /// This is only done for geometry loaded by this layer.
+    UT_Array<GU_ConstDetailHandle>	 mySourceDetails;
     GEO_FilePrim			*myLayerInfoPrim;
     SdfFileFormat::FileFormatArguments	 myCookArgs;
     bool				 mySaveSampleFrame;
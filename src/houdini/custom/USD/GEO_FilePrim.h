@@ -94,7 +94,8 @@ public:
     bool			 getIsDefined() const
 				 { return myIsDefined; }
     void			 setIsDefined(bool defined)
-				 { myIsDefined = defined; }
+				 { myIsDefined = defined;
+				   myIsDefinedAuthored = true; }
 
     bool			 getInitialized() const
 				 { return myInitialized; }
@@ -120,6 +121,17 @@ public:
     void			 replaceMetadata(const TfToken &key,
 					const VtValue &value);
 
+    /// Returns true if nothing has been authored on this prim. Ancestor
+    /// entries created implicitly by GEO_FilePrimMap are empty.
+    bool			 isEmpty() const;
+    /// Merges the contents of \p src (which must have the same path) into
+    /// this prim, giving the same result as if the calls made to author
+    /// \p src had been made on this prim instead. Properties, the type name,
+    /// the defined flag, and replaced metadata from \p src replace existing
+    /// values. Relationships, added metadata, and custom data keep any
+    /// existing values. Child names are not merged.
+    void			 merge(GEO_FilePrim &&src);
+
 private:
     SdfPath			 myPath;
     GEO_FilePropMap		 myProps;
@@ -128,8 +140,13 @@ private:
     TfToken			 myTypeName;
     GEO_FileMetadata		 myMetadata;
     GEO_FileMetadata		 myCustomData;
+    // Track which values were authored with "replace" semantics, so that
+    // merge() can reproduce the result of authoring directly on this prim.
+    TfTokenVector		 myReplacedMetadataKeys;
+    TfTokenVector		 myRelationshipOnlyNames;
     bool			 myInitialized;
     bool			 myIsDefined;
+    bool			 myIsDefinedAuthored;
 };
 
 typedef SdfPathTable<GEO_FilePrim> GEO_FilePrimMap;
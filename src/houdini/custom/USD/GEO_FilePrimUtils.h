@@ -86,6 +86,8 @@ public:
     bool                         myTranslateUVToST = true;
     bool                         mySetDefaultPrim = true;
     bool                         myHeightfieldConvert = false;
+    bool                         myThreadedConversion = true;
+    bool                         myDeferValueConversion = true;
 };
 
 void 
@@ -21,9 +21,12 @@
 #include "GEO_FileFieldValue.h"
 #include <GT/GT_DataArray.h>
 #include <UT/UT_IntrusivePtr.h>
+#include <UT/UT_Lock.h>
 #include <UT/UT_NonCopyable.h>
 #include <UT/UT_TBBSpinLock.h>
 #include <pxr/base/vt/array.h>
+#include <atomic>
+#include <functional>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -89,6 +92,14 @@ private:
                                  if (myPendingDetachCount == 0)
                                  {
                                      UT_ASSERT(myPropSource.get());
+                                     // No arrays reference the extracted
+                                     // data anymore, so any copy made from
+                                     // the source attribute can be freed.
+                                     // This must happen while holding our
+                                     // lock so that a simultaneous
+                                     // copyData() call will re-extract it.
+                                     static_cast<GEO_FilePropAttribSource *>(
+                                         myPropSource.get())->releaseData();
                                      myPropSource.reset();
                                  }
 			     }
@@ -139,11 +150,6 @@ public:
 			     : myAttrib(attrib),
 			       myData(nullptr)
 			 {
-			    GT_DataArrayHandle	 storage;
-                            myData = myAttrib->getArray<ComponentT>(storage);
-
-			    if (storage)
-				myAttrib = storage;
 			 }
 
     bool	         copyData(const GEO_FileFieldValue &value) override
@@ -168,7 +174,7 @@ public:
                             VtArray<T>	 result(
                                 &myForeignSource,
                                 reinterpret_cast<T *>(
-                                    SYSconst_cast(myData)),
+                                    SYSconst_cast(extractData())),
                                 myAttrib->entries(),
                                 false /* addRef */);
 
@@ -177,12 +183,40 @@ public:
 
     GT_Size		 size() const
 			 { return myAttrib->entries(); }
-    const T		*data() const
-			 { return reinterpret_cast<const T *>(myData); }
 
 private:
+    /// Returns a pointer to contiguous data for the attribute. When the
+    /// attribute stores its values contiguously the VtArrays we hand out
+    /// alias that storage directly. Otherwise (e.g. attributes read directly
+    /// from a GU_Detail's paged storage) the values are copied into a
+    /// buffer, which is only held while some VtArray references it.
+    const void		*extractData()
+			 {
+			    UT_Lock::Scope	 lock(myDataLock);
+
+			    if (!myData)
+				myData = myAttrib->getArray<ComponentT>(
+				    myStorage);
+
+			    return myData;
+			 }
+    void		 releaseData()
+			 {
+			    UT_Lock::Scope	 lock(myDataLock);
+
+			    // Data aliasing the attribute itself costs nothing
+			    // to keep around.
+			    if (myStorage)
+			    {
+				myStorage.reset();
+				myData = nullptr;
+			    }
+			 }
+
     GT_DataArrayHandle		 myAttrib;
+    GT_DataArrayHandle		 myStorage;
     const void			*myData;
+    UT_Lock			 myDataLock;
     geo_AttribForeignSource	 myForeignSource;
 };
 
@@ -255,6 +289,47 @@ private:
     VtArray<T>		 myValue;
 };
 
+/// A property source that postpones building the real source until the
+/// value is first requested. The prim hierarchy and property specs of a
+/// layer can be built up front while expensive attribute conversions are
+/// only performed for the fields a stage actually reads.
+class GEO_FilePropDeferredSource : public GEO_FilePropSource
+{
+public:
+    typedef std::function<GEO_FilePropSource *()> Creator;
+
+			 GEO_FilePropDeferredSource(const Creator &creator)
+			     : myCreator(creator),
+			       myIsCreated(false)
+			 { }
+
+    bool	         copyData(const GEO_FileFieldValue &value) override
+			 {
+			     if (!myIsCreated.load(std::memory_order_acquire))
+			     {
+				 UT_Lock::Scope	 lock(myLock);
+
+				 if (!myIsCreated.load(
+					std::memory_order_relaxed))
+				 {
+				     mySource.reset(myCreator());
+				     // Release anything captured by the
+				     // creator, since it won't be needed again.
+				     myCreator = Creator();
+				     myIsCreated.store(true,
+					std::memory_order_release);
+				 }
+			     }
+
+			     return mySource && mySource->copyData(value);
+			 }
+
+private:
+    Creator			 myCreator;
+    GEO_FilePropSourceHandle	 mySource;
+    UT_Lock			 myLock;
+    std::atomic<bool>		 myIsCreated;
+};
 
 PXR_NAMESPACE_CLOSE_SCOPE
 
@@ -25,6 +25,7 @@
 #include <GT/GT_RefineParms.h>
 #include <GU/GU_AgentDefinition.h>
 #include <GU/GU_DetailHandle.h>
+#include <UT/UT_Array.h>
 #include <UT/UT_SharedPtr.h>
 #include <UT/UT_Map.h>
 #include <pxr/pxr.h>
@@ -265,6 +266,10 @@ public:
 
     // Map used to generate unique names for each prim
     std::map<SdfPath, NameInfo> m_names;
+
+    // The details that were refined. Refined prims may reference data owned
+    // by these details, so they must be kept alive as long as the prims.
+    UT_Array<GU_ConstDetailHandle> m_details;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -88,6 +88,7 @@ set( husd_sources
 
     XUSD_AttributeUtils.C
     XUSD_AutoCollection.C
+    XUSD_BoundsCache.C
     XUSD_Data.C
     XUSD_FindPrimsTask.C
     XUSD_HydraCamera.C
@@ -101,6 +102,7 @@ set( husd_sources
     XUSD_OverridesData.C
     XUSD_PathPattern.C
     XUSD_PathSet.C
+    XUSD_PrimIndex.C
     XUSD_RenderSettings.C
     XUSD_RootLayerData.C
     XUSD_ViewerDelegate.C
@@ -200,6 +202,7 @@ set( husd_hdk_headers
 
     XUSD_AttributeUtils.h
     XUSD_AutoCollection.h
+    XUSD_BoundsCache.h
     XUSD_Data.h
     XUSD_DataLock.h
     XUSD_FindPrimsTask.h
@@ -212,6 +215,7 @@ set( husd_hdk_headers
     XUSD_PathPattern.h
     XUSD_PathSet.h
     XUSD_PerfMonAutoCookEvent.h
+    XUSD_PrimIndex.h
     XUSD_RenderSettings.h
     XUSD_RootLayerData.h
     XUSD_Ticket.h
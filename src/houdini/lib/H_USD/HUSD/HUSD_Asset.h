@@ -53,6 +53,10 @@ public:
     // Size in bytes.
     size_t	size() const;
 
+    // Memory held by this asset in bytes. Members read in place from a
+    // shared package buffer don't count the package's memory.
+    int64	getMemoryUsage() const;
+
     // entire buffer of the asset.
     std::shared_ptr<const char> buffer() const;
     
@@ -69,6 +69,15 @@ public:
     /// Sets the time code at which attributes are evaluated and/or set.
     void	 setTimeCode( const HUSD_TimeCode &time_code );
 
+    /// Sets several time codes at which runOverPrimitives() evaluates the
+    /// code, so that each output attribute gets a time sample for each of
+    /// them. The bindings and compiled code are shared by all the time
+    /// codes. Data commands (eg, usd_setattrib()) are only recorded when
+    /// running at the first of the time codes, and are applied once, at the
+    /// time code given to setTimeCode(). An empty list restores the default
+    /// evaluation at a single time code.
+    void	 setTimeCodes( const UT_Array<HUSD_TimeCode> &time_codes );
+
     /// Sets the cvex script bindings map (cvex parm -> usd prim attrib).
     void	 setBindingsMap( const HUSD_CvexBindingMap *map );
 
@@ -155,6 +164,7 @@ private:
     UT_UniquePtr<HUSD_CvexRunData>                       myRunData;
     mutable UT_Array<UT_UniquePtr<husd_CvexResults> >    myResults;
     UT_StringHolder					 myArraySizeHintAttrib;
+    UT_Array<HUSD_TimeCode>				 myTimeCodes;
 
     // Max level of sampling among bound attributes.
     mutable HUSD_TimeSampling		                myTimeSampling;
@@ -26,8 +26,10 @@
 #define __HUSD_PathSet_h__
 
 #include "HUSD_API.h"
+#include <UT/UT_SharedPtr.h>
 #include <UT/UT_StringArray.h>
 #include <UT/UT_StringHolder.h>
+#include <SYS/SYS_Deprecated.h>
 #include <stddef.h>
 #include <pxr/pxr.h>
 
@@ -78,12 +80,23 @@ public:
     void                         erase(const HUSD_Path &path);
     void                         erase(const UT_StringRef &path);
     void                         erase(const UT_StringArray &paths);
+    // Keep only the paths that are also in the other set.
+    void                         intersect(const HUSD_PathSet &other);
     void                         swap(HUSD_PathSet &other);
 
-    PXR_NS::XUSD_PathSet        &sdfPathSet()
-                                 { return *myPathSet; }
+    // Copies of a path set share their paths until one of them is
+    // modified. So editablePathSet() makes a private copy of the paths if
+    // they are shared, while sdfPathSet() never copies. Any reference
+    // returned by either accessor is only valid until this path set is
+    // modified or assigned.
     const PXR_NS::XUSD_PathSet  &sdfPathSet() const
                                  { return *myPathSet; }
+    PXR_NS::XUSD_PathSet        &editablePathSet();
+    // Kept for code written before path sets were shared. Use
+    // editablePathSet() to modify the paths, or the const sdfPathSet().
+    SYS_DEPRECATED_HDK_REPLACE(18.5, editablePathSet)
+    PXR_NS::XUSD_PathSet        &sdfPathSet()
+                                 { return editablePathSet(); }
 
     // Return a python object holding a set of SdfPath python objects.
     void                        *getPythonPathList() const;
@@ -122,7 +135,9 @@ public:
     iterator                     end() const;
 
 private:
-    PXR_NS::XUSD_PathSet        *myPathSet;
+    void                         makeUnique();
+
+    UT_SharedPtr<PXR_NS::XUSD_PathSet> myPathSet;
 };
 
 #endif
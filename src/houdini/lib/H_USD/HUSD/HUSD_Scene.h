@@ -39,6 +39,7 @@
 #include <UT/UT_StringSet.h>
 #include <UT/UT_IntrusivePtr.h>
 #include <UT/UT_Vector2.h>
+#include <SYS/SYS_AtomicInt.h>
 #include <SYS/SYS_Types.h>
 #include <GT/GT_Primitive.h>
 #include "HUSD_PrimHandle.h"
@@ -238,13 +239,14 @@ public:
     static int  getMaxGeoIndex();
     
     // bumped when a geo prim is added or removed.
-    int64	getGeoSerial() const    { return myGeoSerial; }
-    int64	getCameraSerial() const { return myCamSerial; }
-    int64	getLightSerial() const  { return myLightSerial; }
+    int64	getGeoSerial() const    { return myGeoSerial.load(); }
+    int64	getCameraSerial() const { return myCamSerial.load(); }
+    int64	getLightSerial() const  { return myLightSerial.load(); }
     
     // bumped when any prim has Sync() called.
-    int64       getModSerial() const { return myModSerial; }
-    void        bumpModSerial() { myModSerial++; }
+    int64       getModSerial() const { return myModSerial.load(); }
+    // Safe to call from the background merge and Hydra sync threads.
+    void        bumpModSerial() { myModSerial.add(1); }
 
     enum PrimType
     {
@@ -302,6 +304,12 @@ public:
 
     void         postUpdate();
     void         processConsolidatedMeshes(bool finalize);
+    // Displays the consolidated meshes merged in the background by the last
+    // processConsolidatedMeshes(). Returns true if any were changed.
+    bool         publishConsolidatedMeshes();
+    // Called when a background merge of the consolidated meshes finishes,
+    // to have the viewport pick up the merged meshes.
+    void         consolidatedMeshesMerged();
     void         clearInstances(int instr_id, const UT_StringRef &proto_id);
 
     void         debugPrintTree();
@@ -356,10 +364,10 @@ protected:
     bool                                mySelectionArrayNeedsUpdate;
     int64				myHighlightID;
     int64				mySelectionID;
-    int64				myGeoSerial;
-    int64                               myModSerial;
-    int64                               myCamSerial;
-    int64                               myLightSerial;
+    SYS_AtomicInt64			myGeoSerial;
+    SYS_AtomicInt64                     myModSerial;
+    SYS_AtomicInt64                     myCamSerial;
+    SYS_AtomicInt64                     myLightSerial;
     int64                               mySelectionResolveSerial;
     bool				myDeferUpdate;
     UT_Vector2I                         myRenderPrimRes;
@@ -111,6 +111,15 @@ template<typename UT_VALUE_TYPE>
 HUSD_API VtValue
 HUSDgetVtValue( const UT_VALUE_TYPE &ut_value );
 
+/// Conversion function from UT_* value objects to a VtValue holding the
+/// value type of @p type, using the same conversions as HUSDsetAttribute().
+/// Returns an empty VtValue if the value can't be converted. This is for
+/// authoring values directly on an SdfAttributeSpec.
+template<typename UT_VALUE_TYPE>
+HUSD_API VtValue
+HUSDgetVtValueOfType( const UT_VALUE_TYPE &ut_value,
+	const SdfValueTypeName &type );
+
 /// Returns the type of a shader input attribute given the VOP node input.
 HUSD_API SdfValueTypeName   HUSDgetShaderAttribSdfTypeName( 
 	const PRM_Parm &parm );
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2020 Side Effects Software Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Produced by:
+ *	Side Effects Software Inc.
+ *	123 Front Street West, Suite 1401
+ *	Toronto, Ontario
+ *      Canada   M5J 2M2
+ *	416-504-9876
+ *
+ */
+
+#ifndef __XUSD_BoundsCache_h__
+#define __XUSD_BoundsCache_h__
+
+#include "HUSD_API.h"
+#include <UT/UT_Array.h>
+#include <UT/UT_Lock.h>
+#include <UT/UT_TaskLock.h>
+#include <UT/UT_NonCopyable.h>
+#include <UT/UT_SharedPtr.h>
+#include <SYS/SYS_Types.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
+#include <pxr/usd/usdGeom/bboxCache.h>
+#include <pxr/usd/usdGeom/pointInstancer.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/tf/hashmap.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/tf/weakBase.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class XUSD_BoundsCache;
+typedef UT_SharedPtr<XUSD_BoundsCache> XUSD_BoundsCachePtr;
+
+// The world space bounds of every instance of a point instancer.
+class XUSD_InstanceBounds
+{
+public:
+    UT_Int64Array                myIds;
+    UT_Array<GfRange3d>          myRanges;
+};
+typedef UT_SharedPtr<const XUSD_InstanceBounds> XUSD_InstanceBoundsPtr;
+
+// Keeps the world space bounds of the prims on a stage for one time code and
+// set of purposes, so that repeated bounding box queries on an unchanged
+// stage don't have to compute any bounds. The prim bounds are computed for
+// the whole stage at once (which lets USD compute them in parallel), and
+// form a bounding volume hierarchy matching the scene graph hierarchy. The
+// cached bounds are discarded whenever the stage changes.
+class HUSD_API XUSD_BoundsCache : public TfWeakBase,
+                                  public UT_NonCopyable
+{
+public:
+                         XUSD_BoundsCache(const UsdStageRefPtr &stage,
+                                const UsdTimeCode &time,
+                                const TfTokenVector &purposes);
+                        ~XUSD_BoundsCache();
+
+    // Returns the bounds cache for a stage, time code, and purposes,
+    // creating it if it doesn't exist yet.
+    static XUSD_BoundsCachePtr get(const UsdStageRefPtr &stage,
+                                const UsdTimeCode &time,
+                                const TfTokenVector &purposes);
+    // Discards all cached bounds.
+    static void          clear();
+
+    // Returns the world space axis aligned bounds of a prim.
+    GfRange3d            computeWorldRange(const UsdPrim &prim);
+    // Returns the world space axis aligned bounds of all instances of a
+    // point instancer.
+    XUSD_InstanceBoundsPtr computeInstanceBounds(
+                                const UsdGeomPointInstancer &instancer);
+
+private:
+    bool                 isValidFor(const UsdStageRefPtr &stage,
+                                const UsdTimeCode &time,
+                                const TfTokenVector &purposes) const;
+    void                 objectsChanged(const UsdNotice::ObjectsChanged &notice,
+                                const UsdStageWeakPtr &sender);
+
+    typedef TfHashMap<SdfPath, XUSD_InstanceBoundsPtr, SdfPath::Hash>
+        InstanceBoundsMap;
+
+    UsdStageWeakPtr      myStage;
+    UsdTimeCode          myTime;
+    TfTokenVector        myPurposes;
+    TfNotice::Key        myNoticeKey;
+    UsdGeomBBoxCache     myBBoxCache;
+    InstanceBoundsMap    myInstanceBounds;
+    bool                 myIsWarm;
+    // A task lock, since warming the cache computes bounds in parallel
+    // while holding it.
+    UT_TaskLock          myLock;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -44,6 +44,12 @@ class HUSD_API XUSD_FindPrimsTaskData
 public:
     virtual ~XUSD_FindPrimsTaskData();
     virtual void addToThreadData(UsdPrim &prim) = 0;
+    // Decides which prims to add when the traversal isn't restricted by a
+    // pattern or auto collection. Set prune_branch to skip the descendants
+    // of the prim. By default every prim is added.
+    virtual bool matchPrimitive(const UsdPrim &prim,
+                        bool *prune_branch) const
+                 { return true; }
 };
 
 // Subclass of XUSD_FindPrimsTaskData that specifically collects the SdfPaths
@@ -31,7 +31,9 @@
 
 #include <pxr/pxr.h>
 #include <pxr/imaging/hd/renderBuffer.h>
+#include <UT/UT_Array.h>
 #include <UT/UT_Options.h>
+#include <UT/UT_Rect.h>
 #include <UT/UT_StringHolder.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -69,6 +71,22 @@ public:
     /// Return arbitrary metadata associated with this AOV.
     /// Only string values are allowed at the moment.
     virtual const UT_Options &GetMetadata() const = 0;
+
+    /// Find the tiles which may have changed since the given generation,
+    /// returning the current generation.  The tiles apply to the primary
+    /// and the extra planes.  Pass 0 to get all tiles.  Consumers can pass
+    /// the returned generation on subsequent calls so only the tiles which
+    /// have changed need to be copied.
+    ///
+    /// By default changes aren't tracked, so the whole raster is reported
+    /// on every call.
+    virtual exint DirtyTiles(exint since, UT_Array<UT_DimRect> &tiles)
+    {
+	tiles.clear();
+	if (GetWidth() && GetHeight())
+	    tiles.append(UT_DimRect(0, 0, GetWidth(), GetHeight()));
+	return since + 1;
+    }
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
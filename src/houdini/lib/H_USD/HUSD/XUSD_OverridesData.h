@@ -23,12 +23,15 @@
  */
 
 #include "HUSD_Utils.h"
+#include <UT/UT_Array.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/path.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 class XUSD_Data;
+class XUSD_PathSet;
 
 class XUSD_OverridesData
 {
@@ -38,13 +41,50 @@ public:
 
     const SdfLayerRefPtr	&layer(HUSD_OverridesLayerId layer_id) const;
 
+    // Bring a set of layers that matched our layers as of the overrides
+    // version since_version_id up to date with the current contents of
+    // our layers. Layers with only a few recorded prim edits have just
+    // those prims copied. Other changed layers are transferred in full.
+    void			 updateLayers(
+				    const SdfLayerRefPtr *dest_layers,
+				    exint since_version_id) const;
+
     // These methods should only be called by HUSD_Overrides.
-    void			 lockToData(XUSD_Data *data);
+    void			 lockToData(XUSD_Data *data,
+				    exint version_id);
     void			 unlockFromData(XUSD_Data *data);
 
+    // Record the prim paths edited in one of our layers as part of the
+    // overrides version version_id. Any edit that can't be described as
+    // a set of prim paths must be recorded as a change to the whole layer.
+    void			 recordEdit(HUSD_OverridesLayerId layer_id,
+				    exint version_id,
+				    const SdfPath &path);
+    void			 recordEdits(HUSD_OverridesLayerId layer_id,
+				    exint version_id,
+				    const XUSD_PathSet &paths);
+    void			 recordLayerChange(
+				    HUSD_OverridesLayerId layer_id,
+				    exint version_id);
+
 private:
+    struct EditEntry
+    {
+	exint			 myVersionId;
+	SdfPath			 myPath;
+    };
+
+    void			 updateLayer(HUSD_OverridesLayerId layer_id,
+				    const SdfLayerRefPtr &src,
+				    const SdfLayerRefPtr &dest,
+				    exint since_version_id) const;
+
     XUSD_Data			*myLockedToData;
+    exint			 myLockedVersionId;
     SdfLayerRefPtr		 myLayer[HUSD_OVERRIDES_NUM_LAYERS];
+    UT_Array<EditEntry>		 myEdits[HUSD_OVERRIDES_NUM_LAYERS];
+    exint			 myEditVersionId[HUSD_OVERRIDES_NUM_LAYERS];
+    exint			 myLayerChangeVersionId[HUSD_OVERRIDES_NUM_LAYERS];
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
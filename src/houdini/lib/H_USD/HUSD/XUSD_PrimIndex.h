@@ -0,0 +1,114 @@
+/*
+ * Copyright 2020 Side Effects Software Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Produced by:
+ *	Side Effects Software Inc.
+ *	123 Front Street West, Suite 1401
+ *	Toronto, Ontario
+ *      Canada   M5J 2M2
+ *	416-504-9876
+ *
+ */
+
+#ifndef __XUSD_PrimIndex_h__
+#define __XUSD_PrimIndex_h__
+
+#include "HUSD_API.h"
+#include "HUSD_Utils.h"
+#include "XUSD_PathSet.h"
+#include <UT/UT_Lock.h>
+#include <UT/UT_TaskLock.h>
+#include <UT/UT_Map.h>
+#include <UT/UT_NonCopyable.h>
+#include <UT/UT_SharedPtr.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/tf/type.h>
+#include <pxr/base/tf/weakBase.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class XUSD_PrimIndex;
+typedef UT_SharedPtr<XUSD_PrimIndex> XUSD_PrimIndexPtr;
+
+// Index of the prims on a stage by their type name, kind, and purpose. The
+// index is built with a multithreaded traversal the first time it is
+// requested for a stage and a set of traversal demands. After that, it
+// listens for change notices from the stage and only re-traverses the
+// parts of the stage that were changed.
+class HUSD_API XUSD_PrimIndex : public TfWeakBase,
+                                public UT_NonCopyable
+{
+public:
+                         XUSD_PrimIndex(const UsdStageRefPtr &stage,
+                                HUSD_PrimTraversalDemands demands);
+                        ~XUSD_PrimIndex();
+
+    // Returns the index for a stage and traversal demands, creating it if
+    // it doesn't exist yet. Any changes made to the stage since the index
+    // was last used are applied before returning.
+    static XUSD_PrimIndexPtr get(const UsdStageRefPtr &stage,
+                                HUSD_PrimTraversalDemands demands);
+
+    // Add the paths of all prims that are of the given schema type, or of
+    // a type derived from it.
+    void                 findPrimsOfType(const TfType &type,
+                                XUSD_PathSet &paths) const;
+    // Add the paths of all prims with the given kind, or with a kind
+    // derived from it.
+    void                 findPrimsOfKind(const TfToken &kind,
+                                XUSD_PathSet &paths) const;
+    // Add the paths of all imageable prims with the given computed purpose.
+    void                 findPrimsWithPurpose(const TfToken &purpose,
+                                XUSD_PathSet &paths) const;
+    // Returns true if the prim at the given path has any kind authored.
+    bool                 hasKind(const SdfPath &path) const;
+
+private:
+    typedef UT_Map<TfToken, XUSD_PathSet, TfToken::HashFunctor> TokenPathMap;
+
+    bool                 isValidFor(const UsdStageRefPtr &stage,
+                                HUSD_PrimTraversalDemands demands) const;
+    void                 update();
+    void                 indexSubtree(const UsdPrim &prim);
+    void                 indexPrimKind(const UsdPrim &prim);
+    void                 removeSubtree(const SdfPath &path);
+    void                 removePrimKind(const SdfPath &path);
+    void                 objectsChanged(const UsdNotice::ObjectsChanged &notice,
+                                const UsdStageWeakPtr &sender);
+    void                 setNeedsRebuild();
+
+    UsdStageWeakPtr      myStage;
+    HUSD_PrimTraversalDemands myDemands;
+    Usd_PrimFlagsPredicate myPredicate;
+    TfNotice::Key        myNoticeKey;
+    TokenPathMap         myTypeNamePaths;
+    TokenPathMap         myKindPaths;
+    TokenPathMap         myPurposePaths;
+    // Paths changed since the last update. Whole subtrees of the resynced
+    // paths are re-indexed, but only the kind of the info changed paths.
+    // If too many paths change, the index is rebuilt instead.
+    SdfPathVector        myResyncedPaths;
+    SdfPathVector        myInfoChangedPaths;
+    bool                 myNeedsRebuild;
+    // A task lock, since updating the index spawns tasks while holding it.
+    mutable UT_TaskLock  myLock;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -41,6 +41,7 @@ set( gusd_sources
     USD_Utils.cpp
     USD_VisCache.cpp
     USD_XformCache.cpp
+    UT_CappedCache.cpp
     UT_TypeTraits.cpp
     visitor.cpp
     writeCtrlFlags.cpp
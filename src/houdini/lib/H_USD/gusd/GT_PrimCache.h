@@ -42,7 +42,8 @@ PXR_NAMESPACE_OPEN_SCOPE
 // We cache a GT prim for each imageable (leaf node) USD prim and each instance.
 // The GT prims are refined to prims that can be directly imaged in the Houdini 
 // view port.
-// The cache is build atop a UT_CappedCache (a LRU cache).
+// The cache is build atop a GusdUT_ShardedCappedCache (a memory capped cache
+// that favors keeping prims that are expensive to refine).
 
 class GusdGT_PrimCache : public GusdUSD_DataCache {
 
@@ -62,9 +63,14 @@ public:
     void    Clear() override;
     int64   Clear(const UT_StringSet& paths) override;
 
+    const char*         GetName() const override
+                        { return "GusdGT_PrimCache"; }
+    GusdUT_CacheStats   GetStats() const override
+                        { return _prims.GetStats(); }
+
 private:
 
-    GusdUT_CappedCache _prims;
+    GusdUT_ShardedCappedCache _prims;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -26,6 +26,7 @@
 
 #include "gusd/api.h"
 #include "gusd/stageCache.h"
+#include "gusd/UT_CappedCache.h"
 
 #include "pxr/pxr.h"
 #include "pxr/base/tf/token.h"
@@ -55,6 +56,13 @@ public:
     /// Clear caches for a set of stages by path    
     virtual int64   Clear(const UT_StringSet& stagePaths) { return 0; }
 
+    /// Name identifying this cache in GusdStageCache::GetDataCacheStats().
+    virtual const char* GetName() const { return "GusdUSD_DataCache"; }
+
+    /// Return the current size and usage counts of this cache.
+    virtual GusdUT_CacheStats GetStats() const
+                    { return GusdUT_CacheStats(); }
+
 
     /// Helper for implementations to decide if a cache entry
     /// corresponding to @a prim should be discarded.
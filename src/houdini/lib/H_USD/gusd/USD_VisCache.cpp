@@ -244,7 +244,8 @@ namespace {
 
 template <typename KeyT>
 int64
-_RemoveKeysT(const UT_StringSet& paths, GusdUT_CappedCache& cache)
+_RemoveKeysT(const UT_StringSet& paths,
+             GusdUT_ShardedCappedCache& cache)
 {
     return cache.ClearEntries(
         [&](const UT_CappedKeyHandle& key,
@@ -67,6 +67,11 @@ public:
     GUSD_API
     int64   Clear(const UT_StringSet& paths) override;
 
+    const char*         GetName() const override
+                        { return "GusdUSD_VisCache"; }
+    GusdUT_CacheStats   GetStats() const override
+                        { return _visInfos.GetStats(); }
+
 private:
     struct VisInfo : public UT_CappedItem
     {
@@ -90,7 +95,7 @@ private:
                                    UsdTimeCode time,
                                    bool& vis);
 
-    GusdUT_CappedCache  _visInfos;
+    GusdUT_ShardedCappedCache _visInfos;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -440,12 +440,23 @@ GusdUSD_XformCache::Clear()
 }
 
 
+GusdUT_CacheStats
+GusdUSD_XformCache::GetStats() const
+{
+    GusdUT_CacheStats stats = _xforms.GetStats();
+    stats += _worldXforms.GetStats();
+    stats += _xformInfos.GetStats();
+    return stats;
+}
+
+
 namespace {
 
 
 template <typename KeyT>
 int64
-_RemoveKeysT(const UT_StringSet& paths, GusdUT_CappedCache& cache)
+_RemoveKeysT(const UT_StringSet& paths,
+             GusdUT_ShardedCappedCache& cache)
 {
     return cache.ClearEntries(
         [&](const UT_CappedKeyHandle& key,
@@ -131,6 +131,13 @@ public:
     GUSD_API
     int64           Clear(const UT_StringSet& paths) override;
 
+    const char*     GetName() const override
+                    { return "GusdUSD_XformCache"; }
+
+    /// Combined statistics of the local, world and xform query caches.
+    GUSD_API
+    GusdUT_CacheStats GetStats() const override;
+
 private:
     bool    _GetLocalTransformation(const UsdPrim& prim,
                                     UsdTimeCode time,
@@ -140,7 +147,7 @@ private:
 
 
 private:
-    GusdUT_CappedCache  _xforms, _worldXforms, _xformInfos;
+    GusdUT_ShardedCappedCache _xforms, _worldXforms, _xformInfos;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,301 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "gusd/UT_CappedCache.h"
+
+#include <SYS/SYS_Math.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+/// Convert a rebuild cost and size to a GreedyDual-Size priority boost.
+/// Costs are measured in milliseconds with a baseline of one, so that items
+/// of unknown cost are still weighted by size, and sizes in kilobytes.
+double
+_ComputeBenefit(double cost, int64 memory)
+{
+    const double size = SYSmax(double(memory) / 1024.0, 1.0);
+    return (1.0 + cost * 1000.0) / size;
+}
+
+} // namespace
+
+
+GusdUT_ShardedCappedCache::GusdUT_ShardedCappedCache(
+    const char* name,
+    int64 size_in_mb,
+    int numShards)
+    : _name(name)
+    , _maxSize(size_in_mb * 1024 * 1024)
+    , _memory(0)
+    , _age(0.0)
+{
+    UT_ASSERT(numShards > 0);
+    _shards.setSize(SYSmax(numShards, 1));
+    for(auto& shard : _shards)
+        shard.reset(new _Shard);
+}
+
+
+GusdUT_ShardedCappedCache::~GusdUT_ShardedCappedCache()
+{
+}
+
+
+void
+GusdUT_ShardedCappedCache::_Shard::touch(_Entry& entry, double age)
+{
+    if(entry.queueIt != queue.end())
+        queue.erase(entry.queueIt);
+
+    _QueueEntry qentry;
+    qentry.priority = age + _ComputeBenefit(entry.cost, entry.memory);
+    qentry.serial = serial++;
+    qentry.key = entry.key.get();
+    entry.queueIt = queue.insert(qentry).first;
+}
+
+
+GusdUT_ShardedCappedCache::_Queue::iterator
+GusdUT_ShardedCappedCache::_Shard::lowest(const UT_CappedKey* keep)
+{
+    auto qit = queue.begin();
+
+    if(keep && qit != queue.end() && qit->key->isEqual(*keep))
+        ++qit;
+    return qit;
+}
+
+
+bool
+GusdUT_ShardedCappedCache::_EvictLowest(const UT_CappedKey* keep,
+                                        int64& freed)
+{
+    // Find the shard holding the lowest priority item. Each shard is only
+    // locked while it is examined, so the item that is finally evicted is
+    // that shard's lowest priority item at the time, which may have changed
+    // if it was used in the meantime.
+    _Shard* victim = nullptr;
+    double priority = 0.0;
+
+    for(auto& shard : _shards) {
+        UT_Lock::Scope lock(shard->lock);
+
+        auto qit = shard->lowest(keep);
+        if(qit != shard->queue.end() &&
+           (!victim || qit->priority < priority)) {
+            victim = shard.get();
+            priority = qit->priority;
+        }
+    }
+    if(!victim)
+        return false;
+
+    UT_Lock::Scope lock(victim->lock);
+
+    // The shard may have been emptied since it was examined, in which case
+    // the caller just tries again.
+    auto qit = victim->lowest(keep);
+    if(qit == victim->queue.end())
+        return true;
+
+    auto it = victim->entries.find(qit->key);
+
+    UT_ASSERT(it != victim->entries.end());
+    // Age the cache so that items which are not used eventually fall below
+    // newly added ones, regardless of their cost.
+    _age.store(SYSmax(_age.load(), qit->priority));
+    freed += it->second.memory;
+    victim->memory -= it->second.memory;
+    _memory.add(-it->second.memory);
+    victim->queue.erase(qit);
+    victim->entries.erase(it);
+    _evictions.add(1);
+    return true;
+}
+
+
+void
+GusdUT_ShardedCappedCache::_EnforceMaxSize(const UT_CappedKey* keep)
+{
+    if(_memory.load() <= _maxSize)
+        return;
+
+    // Only one thread evicts at a time, so that threads adding items at the
+    // same time don't each evict items to make room for the same excess.
+    UT_Lock::Scope lock(_evictLock);
+    int64 freed = 0;
+
+    while(_memory.load() > _maxSize) {
+        if(!_EvictLowest(keep, freed))
+            break;
+    }
+}
+
+
+UT_CappedItemHandle
+GusdUT_ShardedCappedCache::_FindItem(const UT_CappedKey& key)
+{
+    _Shard& shard = _GetShard(key);
+    UT_Lock::Scope lock(shard.lock);
+
+    auto it = shard.entries.find(&key);
+    if(it != shard.entries.end()) {
+        shard.touch(it->second, _age.load());
+        return it->second.item;
+    }
+    return UT_CappedItemHandle();
+}
+
+
+UT_CappedItemHandle
+GusdUT_ShardedCappedCache::findItem(const UT_CappedKey& key)
+{
+    UT_CappedItemHandle item = _FindItem(key);
+
+    if(item)
+        _hits.add(1);
+    else
+        _misses.add(1);
+    return item;
+}
+
+
+UT_CappedItemHandle
+GusdUT_ShardedCappedCache::addItem(
+    const UT_CappedKey& key,
+    const UT_CappedItemHandle& item,
+    double cost)
+{
+    _Shard& shard = _GetShard(key);
+    UT_CappedItemHandle result;
+
+    {
+        UT_Lock::Scope lock(shard.lock);
+
+        auto it = shard.entries.find(&key);
+        if(it == shard.entries.end()) {
+            // The map's key must point at the key owned by the entry.
+            UT_CappedKeyHandle keyHnd(key.duplicate());
+            it = shard.entries.emplace(keyHnd.get(), _Entry()).first;
+
+            _Entry& entry = it->second;
+            entry.key = keyHnd;
+            entry.item = item;
+            entry.memory = item->getMemoryUsage();
+            entry.cost = cost;
+            entry.queueIt = shard.queue.end();
+            shard.memory += entry.memory;
+            _memory.add(entry.memory);
+        }
+        shard.touch(it->second, _age.load());
+        result = it->second.item;
+    }
+
+    // Make room for the new item. The new item itself is kept even if it
+    // is larger than the whole cache, matching UT_CappedCache, until a
+    // later add pushes it out.
+    _EnforceMaxSize(&key);
+    return result;
+}
+
+
+void
+GusdUT_ShardedCappedCache::deleteItem(const UT_CappedKey& key)
+{
+    _Shard& shard = _GetShard(key);
+    UT_Lock::Scope lock(shard.lock);
+
+    auto it = shard.entries.find(&key);
+    if(it != shard.entries.end()) {
+        shard.memory -= it->second.memory;
+        _memory.add(-it->second.memory);
+        shard.queue.erase(it->second.queueIt);
+        shard.entries.erase(it);
+    }
+}
+
+
+void
+GusdUT_ShardedCappedCache::clear()
+{
+    for(auto& shard : _shards) {
+        UT_Lock::Scope lock(shard->lock);
+
+        shard->entries.clear();
+        shard->queue.clear();
+        _memory.add(-shard->memory);
+        shard->memory = 0;
+    }
+    _age.store(0.0);
+}
+
+
+void
+GusdUT_ShardedCappedCache::setMaxSize(int64 size_in_bytes)
+{
+    _maxSize = SYSmax(size_in_bytes, int64(0));
+    _EnforceMaxSize(nullptr);
+}
+
+
+int64
+GusdUT_ShardedCappedCache::getMemoryUsage() const
+{
+    return _memory.load();
+}
+
+
+int64
+GusdUT_ShardedCappedCache::utReduceCacheSizeBy(int64 amount)
+{
+    UT_Lock::Scope lock(_evictLock);
+    int64 freed = 0;
+
+    while(freed < amount) {
+        if(!_EvictLowest(nullptr, freed))
+            break;
+    }
+    return freed;
+}
+
+
+GusdUT_CacheStats
+GusdUT_ShardedCappedCache::GetStats() const
+{
+    GusdUT_CacheStats stats;
+
+    for(auto& shard : _shards) {
+        UT_Lock::Scope lock(shard->lock);
+        stats.entries += shard->entries.size();
+        stats.memory += shard->memory;
+    }
+    stats.hits = _hits.load();
+    stats.misses = _misses.load();
+    stats.evictions = _evictions.load();
+    stats.computeTime = _computeTime.load() * 1e-6;
+    return stats;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
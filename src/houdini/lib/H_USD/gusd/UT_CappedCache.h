@@ -30,11 +30,23 @@
 
 #include "pxr/pxr.h"
 
+#include "gusd/api.h"
+
 #include <SYS/SYS_AtomicInt.h>
+#include <UT/UT_Array.h>
 #include <UT/UT_Assert.h>
+#include <UT/UT_Cache.h>
 #include <UT/UT_CappedCache.h>
 #include <UT/UT_ConcurrentHashMap.h>
 #include <UT/UT_IntrusivePtr.h>
+#include <UT/UT_Lock.h>
+#include <UT/UT_StringHolder.h>
+#include <UT/UT_UniquePtr.h>
+
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <unordered_map>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -75,16 +87,73 @@ private:
 };
 
 
-/** Variant of UT_CappedCache that improves on item construction.
-    This adds in a mechanism for locking items during construction,
-    to prevent multiple threads from performing the same work to
-    initialize cache items.*/
-class GusdUT_CappedCache : public UT_CappedCache
+/// Usage statistics for a cache.
+struct GusdUT_CacheStats
+{
+    GusdUT_CacheStats()
+        : entries(0), memory(0), hits(0), misses(0), evictions(0),
+          computeTime(0.0) {}
+
+    GusdUT_CacheStats& operator+=(const GusdUT_CacheStats& o)
+    {
+        entries += o.entries;
+        memory += o.memory;
+        hits += o.hits;
+        misses += o.misses;
+        evictions += o.evictions;
+        computeTime += o.computeTime;
+        return *this;
+    }
+
+    /// Number of items currently in the cache.
+    int64   entries;
+    /// Memory used by the items currently in the cache, in bytes.
+    int64   memory;
+    /// Number of lookups that found an item.
+    int64   hits;
+    /// Number of lookups that did not find an item.
+    int64   misses;
+    /// Number of items removed to keep the cache under its size limit.
+    int64   evictions;
+    /// Total time spent creating items in FindOrCreate(), in seconds.
+    double  computeTime;
+};
+
+
+/** Memory-capped cache split into independently locked shards.
+
+    This adds a mechanism for locking items during construction, to
+    prevent multiple threads from performing the same work to initialize
+    cache items. Keys are distributed across shards by hash so that threads
+    working on different items rarely contend for the same lock.
+
+    Rather than pure LRU, items are evicted using the GreedyDual-Size
+    policy: each item's priority is the cache's current "age" plus the cost
+    of rebuilding the item divided by its size, and the lowest priority
+    item in any shard is evicted first. Items that are expensive to rebuild
+    relative to their size therefore survive longer than cheap or large
+    ones, while items that are not used age out as the cache's age
+    increases. The rebuild cost is the time spent in the creator passed to
+    FindOrCreate(), or can be given explicitly to addItem().*/
+class GUSD_API GusdUT_ShardedCappedCache : public UT_Cache
 {
 public:
-    GusdUT_CappedCache(const char* name, int64 size_in_mb=32)
-        : UT_CappedCache(name, size_in_mb) {}
-    ~GusdUT_CappedCache() override {}
+    GusdUT_ShardedCappedCache(const char* name, int64 size_in_mb=32,
+                              int numShards=16);
+    ~GusdUT_ShardedCappedCache() override;
+
+    UT_CappedItemHandle         findItem(const UT_CappedKey& key);
+
+    /// Add an item to the cache, returning the cached item. If an item with
+    /// the same key already exists, that item is returned instead.
+    /// @a cost is the time in seconds it took to create the item.
+    UT_CappedItemHandle         addItem(const UT_CappedKey& key,
+                                        const UT_CappedItemHandle& item,
+                                        double cost=0.0);
+
+    void                        deleteItem(const UT_CappedKey& key);
+
+    void                        clear();
 
     template <typename Item>
     UT_IntrusivePtr<const Item> Find(const UT_CappedKey& key);
@@ -94,19 +163,32 @@ public:
                                              const Creator& creator,
                                              Args&... args);
 
-    template <typename T>
-    bool                        FindVal(const UT_CappedKey& key);
-
-    template <typename T,typename Creator,typename... Args>
-    bool                        FindOrCreateVal(const UT_CappedKey& key,
-                                                const Creator& creator,
-                                                Args&... args);
-    
+    /// Remove all entries for which @a matchFn(key, item) returns true.
+    /// Returns the amount of memory freed.
     template <typename MatchFn>
     int64                       ClearEntries(const MatchFn& matchFn);
-    
-private:
 
+    GusdUT_CacheStats           GetStats() const;
+
+    int64                       getMaxSize() const
+                                { return _maxSize; }
+    void                        setMaxSize(int64 size_in_bytes);
+    int64                       getMemoryUsage() const;
+
+    // UT_Cache interface
+    const char*                 utGetCacheName() const override
+                                { return _name.c_str(); }
+    bool                        utHasMaxSize() const override
+                                { return true; }
+    int64                       utGetMaxSize() const override
+                                { return getMaxSize(); }
+    void                        utSetMaxSize(int64 size) override
+                                { setMaxSize(size); }
+    int64                       utGetCurrentSize() const override
+                                { return getMemoryUsage(); }
+    int64                       utReduceCacheSizeBy(int64 amount) override;
+
+private:
     struct _HashCompare
     {
         static size_t   hash(const UT_CappedKeyHandle& k)
@@ -115,18 +197,112 @@ private:
                               const UT_CappedKeyHandle& b)
                         { return a->isEqual(*b); }
     };
-    
-    
+
+    // Entries are looked up by key pointer, so that lookups don't need to
+    // take ownership of the caller's key.
+    struct _KeyPtrHashCompare
+    {
+        size_t          operator()(const UT_CappedKey* k) const
+                        { return (size_t)k->getHash(); }
+        bool            operator()(const UT_CappedKey* a,
+                                   const UT_CappedKey* b) const
+                        { return a->isEqual(*b); }
+    };
+
+    // Entries in a shard's eviction queue, ordered by priority. The serial
+    // number keeps the order stable between items of equal priority.
+    struct _QueueEntry
+    {
+        bool            operator<(const _QueueEntry& o) const
+                        {
+                            return priority < o.priority ||
+                                (priority == o.priority && serial < o.serial);
+                        }
+
+        double              priority;
+        int64               serial;
+        const UT_CappedKey* key;
+    };
+    typedef std::set<_QueueEntry> _Queue;
+
+    struct _Entry
+    {
+        UT_CappedKeyHandle  key;
+        UT_CappedItemHandle item;
+        int64               memory;
+        double              cost;
+        _Queue::iterator    queueIt;
+    };
+    typedef std::unordered_map<const UT_CappedKey*, _Entry,
+                               _KeyPtrHashCompare,
+                               _KeyPtrHashCompare> _EntryMap;
+
+    struct _Shard
+    {
+        _Shard() : memory(0), serial(0) {}
+
+        /// Moves an entry to its new position in the queue after being
+        /// added or used, given the cache's current @a age. Must be called
+        /// with the lock held.
+        void            touch(_Entry& entry, double age);
+        /// Returns the lowest priority item in the queue other than the
+        /// one matching @a keep. Must be called with the lock held.
+        _Queue::iterator lowest(const UT_CappedKey* keep);
+
+        UT_Lock         lock;
+        _EntryMap       entries;
+        _Queue          queue;
+        int64           memory;
+        int64           serial;
+    };
+
+    _Shard&             _GetShard(const UT_CappedKey& key)
+                        { return *_shards(key.getHash() % _shards.size()); }
+
+    /// Evict the lowest priority item of all shards, other than the item
+    /// matching @a keep, adding the number of bytes freed to @a freed.
+    /// Returns false if there was nothing to evict. Must be called with
+    /// _evictLock held.
+    bool                _EvictLowest(const UT_CappedKey* keep, int64& freed);
+
+    /// Evict items until the total memory of all shards is no more than
+    /// the maximum size. The item matching @a keep (usually one that was
+    /// just added) is not evicted.
+    void                _EnforceMaxSize(const UT_CappedKey* keep);
+
+    /// Look up an item without counting a hit or a miss.
+    UT_CappedItemHandle _FindItem(const UT_CappedKey& key);
+
     typedef UT_ConcurrentHashMap<UT_CappedKeyHandle,
                                  UT_CappedItemHandle,
                                  _HashCompare>  _ConstructMap;
-    _ConstructMap   _constructMap;
+
+    UT_StringHolder             _name;
+    int64                       _maxSize;
+    UT_Array<UT_UniquePtr<_Shard>> _shards;
+    _ConstructMap               _constructMap;
+
+    // The size limit applies to the total of all shards, so that a single
+    // shard can grow past an even share of the limit.
+    SYS_AtomicInt64             _memory;
+
+    // The GreedyDual-Size age is shared by all shards, so that priorities
+    // can be compared between shards. It is only raised by evictions,
+    // which are serialized by _evictLock.
+    std::atomic<double>         _age;
+    UT_Lock                     _evictLock;
+
+    SYS_AtomicInt64             _hits;
+    SYS_AtomicInt64             _misses;
+    SYS_AtomicInt64             _evictions;
+    // Time spent in creators, in microseconds.
+    SYS_AtomicInt64             _computeTime;
 };
 
 
 template <typename Item>
 UT_IntrusivePtr<const Item>
-GusdUT_CappedCache::Find(const UT_CappedKey& key)
+GusdUT_ShardedCappedCache::Find(const UT_CappedKey& key)
 {
     if(UT_CappedItemHandle hnd = findItem(key))
         return UT_IntrusivePtr<const Item>(
@@ -137,9 +313,9 @@ GusdUT_CappedCache::Find(const UT_CappedKey& key)
 
 template <typename Item, typename Creator, typename... Args>
 UT_IntrusivePtr<const Item>
-GusdUT_CappedCache::FindOrCreate(const UT_CappedKey& key,
-                                 const Creator& creator,
-                                 Args&... args)
+GusdUT_ShardedCappedCache::FindOrCreate(const UT_CappedKey& key,
+                                        const Creator& creator,
+                                        Args&... args)
 {
     if(auto item = Find<Item>(key))
         return item;
@@ -148,11 +324,18 @@ GusdUT_CappedCache::FindOrCreate(const UT_CappedKey& key,
 
     _ConstructMap::accessor a;
     if(_constructMap.insert(a, keyHnd)) {
-        // Make sure another thread didn't beat us to it.
-        a->second = findItem(key);
+        // Make sure another thread didn't beat us to it. The miss was
+        // already counted by the lookup above.
+        a->second = _FindItem(key);
         if(!a->second) {
-            if((a->second = creator(args...))) {
-                addItem(key, a->second);
+            const auto start = std::chrono::steady_clock::now();
+            a->second = creator(args...);
+            const std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - start;
+
+            _computeTime.add(int64(elapsed.count() * 1e6));
+            if(a->second) {
+                a->second = addItem(key, a->second, elapsed.count());
             } else {
                 _constructMap.erase(a);
                 return UT_IntrusivePtr<const Item>();
@@ -165,24 +348,29 @@ GusdUT_CappedCache::FindOrCreate(const UT_CappedKey& key,
     return item;
 }
 
+
 template <typename MatchFn>
 int64
-GusdUT_CappedCache::ClearEntries(const MatchFn& matchFn)
+GusdUT_ShardedCappedCache::ClearEntries(const MatchFn& matchFn)
 {
     int64 freed = 0;
 
-    auto traverseFn([&](const UT_CappedKeyHandle& key,
-                        const UT_CappedItemHandle& item)
-        {
-            if(matchFn(key, item)) {
-                freed += item->getMemoryUsage();
-                // XXX: deleteItem() is safe in threadSafeTraversal!
-                this->deleteItem(*key);
+    for(auto& shard : _shards) {
+        UT_Lock::Scope lock(shard->lock);
+
+        for(auto it = shard->entries.begin(); it != shard->entries.end(); ) {
+            if(matchFn(it->second.key, it->second.item)) {
+                freed += it->second.memory;
+                shard->memory -= it->second.memory;
+                _memory.add(-it->second.memory);
+                shard->queue.erase(it->second.queueIt);
+                it = shard->entries.erase(it);
+            } else {
+                ++it;
             }
-            return true;
-        });
-    threadSafeTraversal(traverseFn);
-   return freed;
+        }
+    }
+    return freed;
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -23,6 +23,9 @@
 //
 #include "boundsCache.h"
 
+#include <UT/UT_ScopeExit.h>
+
+#include <chrono>
 #include <iostream>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -30,6 +33,16 @@ PXR_NAMESPACE_OPEN_SCOPE
 using std::cerr;
 using std::endl;
 
+namespace {
+
+// The number of caches kept for each stage and set of purposes. This
+// bounds the number of time samples kept. More caches are created while
+// more threads than this compute bounds on the same stage at once, but
+// they are discarded again once idle.
+constexpr exint theMaxCachesPerStage = 8;
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 /* static */ 
@@ -41,6 +54,10 @@ GusdBoundsCache::GetInstance()
 }
 
 GusdBoundsCache::GusdBoundsCache() 
+    : m_hits( 0 )
+    , m_misses( 0 )
+    , m_evictions( 0 )
+    , m_computeTime( 0 )
 {
 }
 
@@ -78,6 +95,107 @@ GusdBoundsCache::ComputeUntransformedBound(
                 bounds );
 }
 
+GusdBoundsCache::CacheEntryHandle
+GusdBoundsCache::Item::Acquire( UsdTimeCode time, AcquireResult &result )
+{
+    CacheEntryHandle lru;
+    CacheEntryHandle mru;
+    bool retime = false;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+
+        for( auto const& entry : caches ) {
+            if( entry->inUse )
+                continue;
+            if( entry->bboxCache.GetTime() == time ) {
+                entry->inUse = true;
+                result = ACQUIRE_HIT;
+                return entry;
+            }
+            if( !lru || entry->lastUsed < lru->lastUsed )
+                lru = entry;
+            if( !mru || entry->lastUsed > mru->lastUsed )
+                mru = entry;
+        }
+
+        // Reserve the cache we are about to retime or copy, so that no
+        // other thread touches it once the lock is released.
+        if( lru && caches.size() >= theMaxCachesPerStage ) {
+            lru->inUse = true;
+            retime = true;
+        }
+        else if( mru )
+            mru->inUse = true;
+    }
+
+    // Retiming or copying a cache can take a while, so it is done without
+    // holding the lock, which every other reader of this pool needs.
+
+    // Retiming a cache only discards the bounds of time varying prims.
+    if( retime ) {
+        bool retimed = false;
+        UT_AT_SCOPE_EXIT( if( !retimed ) Release( lru ) );
+
+        lru->bboxCache.SetTime( time );
+        retimed = true;
+        result = ACQUIRE_RETIMED;
+        return lru;
+    }
+
+    // Prefer growing the pool to retiming an existing cache, so that
+    // recently used frames stay cached. Copying an idle cache keeps the
+    // bounds of static prims it has already computed. If every cache is
+    // busy, the pool grows past its normal size rather than making the
+    // caller wait or use a throwaway cache. Release() trims it back down.
+    CacheEntryHandle entry;
+    if( mru ) {
+        UT_AT_SCOPE_EXIT( Unreserve( mru ) );
+
+        entry = new CacheEntry( mru->bboxCache );
+        entry->bboxCache.SetTime( time );
+    }
+    else
+        entry = new CacheEntry( time, purposes );
+    entry->inUse = true;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        caches.append( entry );
+    }
+    result = ACQUIRE_NEW;
+    return entry;
+}
+
+void
+GusdBoundsCache::Item::Unreserve( const CacheEntryHandle &entry )
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    entry->inUse = false;
+}
+
+void
+GusdBoundsCache::Item::Release( const CacheEntryHandle &entry )
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    entry->inUse = false;
+    entry->lastUsed = ++useCounter;
+
+    // Discard idle caches that were only added because the pool was busy.
+    while( caches.size() > theMaxCachesPerStage ) {
+        exint lru = -1;
+        for( exint i = 0, n = caches.size(); i < n; ++i ) {
+            if( caches[i]->inUse )
+                continue;
+            if( lru < 0 || caches[i]->lastUsed < caches[lru]->lastUsed )
+                lru = i;
+        }
+        if( lru < 0 )
+            break;
+        caches.removeIndex( lru );
+    }
+}
+
 bool 
 GusdBoundsCache::_ComputeBound(
     const UsdPrim &prim,
@@ -93,18 +211,41 @@ GusdBoundsCache::_ComputeBound(
 	    ? prim.GetStage()->GetRootLayer()->GetIdentifier()
 	    : prim.GetStage()->GetRootLayer()->GetRealPath() );
 
-    MapType::accessor accessor;
-    if( !m_map.find( accessor, Key( stageId, includedPurposes ))) {
-        m_map.insert( accessor, Key( stageId, includedPurposes ) );
-        accessor->second = new Item( time, includedPurposes );
+    const Key key( stageId, includedPurposes );
+    ItemHandle item;
+    {
+        UT_AutoReadLock mapLock( m_mapLock );
+        {
+            MapType::const_accessor caccessor;
+            if( m_map.find( caccessor, key ))
+                item = caccessor->second;
+        }
+        if( !item ) {
+            MapType::accessor accessor;
+            if( m_map.insert( accessor, key ))
+                accessor->second = new Item( includedPurposes );
+            item = accessor->second;
+        }
     }
-    std::lock_guard<std::mutex> lock(accessor->second->lock);
-    UsdGeomBBoxCache& cache = accessor->second->bboxCache;
 
-    cache.SetTime( time );
+    Item::AcquireResult result;
+    CacheEntryHandle entry = item->Acquire( time, result );
+    UT_AT_SCOPE_EXIT( item->Release( entry ) );
+
+    if( result == Item::ACQUIRE_HIT )
+        m_hits.add( 1 );
+    else
+        m_misses.add( 1 );
+    if( result == Item::ACQUIRE_RETIMED )
+        m_evictions.add( 1 );
+
+    const auto start = std::chrono::steady_clock::now();
 
     // boundFunc is either ComputeWorldBound or ComputeLocalBound
-    GfBBox3d primBBox = (cache.*boundFunc)(prim);
+    GfBBox3d primBBox = (entry->bboxCache.*boundFunc)(prim);
+
+    m_computeTime.add( std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - start ).count() );
 
     if( !primBBox.GetRange().IsEmpty() ) 
     {
@@ -127,6 +268,7 @@ GusdBoundsCache::_ComputeBound(
 void
 GusdBoundsCache::Clear()
 {
+    UT_AutoWriteLock mapLock( m_mapLock );
     m_map.clear();
 }
 
@@ -134,6 +276,7 @@ int64
 GusdBoundsCache::Clear(const UT_StringSet& paths)
 {
     int64 freed = 0;
+    UT_AutoWriteLock mapLock( m_mapLock );
 
     UT_Array<Key> keys;
     for( auto const& entry : m_map ) {
@@ -148,4 +291,26 @@ GusdBoundsCache::Clear(const UT_StringSet& paths)
     return freed;    
 }
 
+GusdUT_CacheStats
+GusdBoundsCache::GetStats() const
+{
+    GusdUT_CacheStats stats;
+
+    {
+        UT_AutoWriteLock mapLock( m_mapLock );
+        for( auto const& entry : m_map ) {
+            Item &item = *entry.second;
+            std::lock_guard<std::mutex> guard(item.lock);
+            stats.entries += item.caches.size();
+        }
+    }
+    // The size of the UsdGeomBBoxCache contents is unknown.
+    stats.memory = 0;
+    stats.hits = m_hits.load();
+    stats.misses = m_misses.load();
+    stats.evictions = m_evictions.load();
+    stats.computeTime = m_computeTime.load() * 1e-6;
+    return stats;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
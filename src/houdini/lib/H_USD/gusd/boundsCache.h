@@ -31,20 +31,35 @@
 
 #include "USD_DataCache.h"
 
+#include <UT/UT_Array.h>
 #include <UT/UT_BoundingBox.h>
 #include <UT/UT_IntrusivePtr.h>
 #include <UT/UT_ConcurrentHashMap.h>
+#include <UT/UT_RWLock.h>
+
+#include <SYS/SYS_AtomicInt.h>
+
+#include <mutex>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 /// A wrapper arround UsdGeomBBoxCache. 
 ///
-/// This singleton class keeps a cache per stage and per purpose.
+/// This singleton class keeps a set of caches per stage and per purpose.
 /// It will be flushed when the stage cache is flushed. 
 ///
-/// Unfortunaly UsdGeomBBoxCaches only store a single frame at
-/// a time. I considered creating a cache per frame but I thought
-/// that would defeat optimizations for non animated geometry.
+/// UsdGeomBBoxCaches only store a single frame at a time, but when their
+/// time is changed they keep the bounds of prims that are not time varying.
+/// So rather than creating a cache per frame, we keep a small pool of
+/// caches per stage. A query first looks for an idle cache already set to
+/// the requested time. Otherwise the pool grows by copying an idle cache,
+/// so the new cache starts with the bounds of static prims, or once the
+/// pool is full the least recently used idle cache is retimed. If every
+/// cache is busy the pool grows past its normal size, and the extra caches
+/// are discarded again as they become idle. This lets several frames stay
+/// cached at once while sharing the bounds of static prims, and lets
+/// threads compute bounds concurrently instead of serializing on a single
+/// cache.
 
 class GusdBoundsCache : public GusdUSD_DataCache {
 public:
@@ -68,6 +83,14 @@ public:
     void Clear() override;
     int64 Clear(const UT_StringSet& stageNames) override;
 
+    const char* GetName() const override { return "GusdBoundsCache"; }
+
+    /// Each pooled UsdGeomBBoxCache is one entry. UsdGeomBBoxCache doesn't
+    /// report the size of its contents, so the memory is reported as 0
+    /// (unknown). A lookup is a hit if an idle cache was already set to the
+    /// requested time, and retiming a cache counts as an eviction.
+    GusdUT_CacheStats GetStats() const override;
+
 private:
 
     // Key that hashes the stage file name and a set of purposes.
@@ -106,14 +129,57 @@ private:
         std::size_t         hash;
     };
 
-    struct Item : public UT_IntrusiveRefCounter<Item>
+    // A single UsdGeomBBoxCache. Only one thread can use it at a time.
+    struct CacheEntry : public UT_IntrusiveRefCounter<CacheEntry>
     {
-        Item( UsdTimeCode time, const TfTokenVector& includedPurposes ) 
+        CacheEntry( UsdTimeCode time, const TfTokenVector& includedPurposes )
             : bboxCache( time, includedPurposes )
+            , lastUsed( 0 )
+            , inUse( false )
         {
         }
-        
+        CacheEntry( const UsdGeomBBoxCache& src )
+            : bboxCache( src )
+            , lastUsed( 0 )
+            , inUse( false )
+        {
+        }
+
         UsdGeomBBoxCache bboxCache;
+        exint lastUsed;
+        bool inUse;
+    };
+
+    typedef UT_IntrusivePtr<CacheEntry> CacheEntryHandle;
+
+    // The pool of caches for a stage and set of purposes.
+    struct Item : public UT_IntrusiveRefCounter<Item>
+    {
+        Item( const TfTokenVector& includedPurposes ) 
+            : purposes( includedPurposes )
+            , useCounter( 0 )
+        {
+        }
+
+        enum AcquireResult
+        {
+            ACQUIRE_HIT,        // An idle cache was already at the time.
+            ACQUIRE_NEW,        // A new cache was added to the pool.
+            ACQUIRE_RETIMED     // The least recently used cache was retimed.
+        };
+
+        /// Returns an idle cache set to @a time, marking it as in use.
+        CacheEntryHandle    Acquire( UsdTimeCode time,
+                                     AcquireResult &result );
+        /// Marks a cache returned by Acquire() as idle again.
+        void                Release( const CacheEntryHandle &entry );
+        /// Marks a cache reserved by Acquire() as idle again, without
+        /// counting it as used.
+        void                Unreserve( const CacheEntryHandle &entry );
+
+        TfTokenVector purposes;
+        UT_Array<CacheEntryHandle> caches;
+        exint useCounter;
         std::mutex lock;
     };
 
@@ -130,6 +196,16 @@ private:
 
     typedef UT_ConcurrentHashMap<Key,ItemHandle,Key::HashCmp> MapType;
     MapType   m_map;
+    // Lookups and inserts take this for reading, since the map allows them
+    // to run concurrently. Anything that iterates over or erases from the
+    // map takes it for writing.
+    mutable UT_RWLock m_mapLock;
+
+    SYS_AtomicInt64 m_hits;
+    SYS_AtomicInt64 m_misses;
+    SYS_AtomicInt64 m_evictions;
+    // Time spent computing bounds, in microseconds.
+    SYS_AtomicInt64 m_computeTime;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -426,6 +426,17 @@ public:
                             _dataCaches.removeIndex(idx);
                     }
 
+    void            GetDataCacheStats(
+                        UT_StringMap<GusdUT_CacheStats>& stats)
+                    {
+                        UT_AutoLock lock(_dataCacheLock);
+                        for(auto* cache : _dataCaches) {
+                            UT_ASSERT_P(cache);
+                            stats[UT_StringHolder(cache->GetName())] +=
+                                cache->GetStats();
+                        }
+                    }
+
     void            FindStages(const UT_StringSet& paths,
                                UT_Set<UsdStageRefPtr>& stages) const;
 
@@ -1831,6 +1842,14 @@ GusdStageCache::RemoveDataCache(GusdUSD_DataCache& cache)
 }
 
 
+void
+GusdStageCache::GetDataCacheStats(
+    UT_StringMap<GusdUT_CacheStats>& stats) const
+{
+    _impl->GetDataCacheStats(stats);
+}
+
+
 GusdStageCacheReader::GusdStageCacheReader(GusdStageCache& cache, bool writer)
     : _cache(cache), _writer(writer)
 {
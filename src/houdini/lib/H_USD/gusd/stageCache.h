@@ -27,6 +27,7 @@
 #include <UT/UT_Array.h>
 #include <UT/UT_Error.h>
 #include <UT/UT_Set.h>
+#include <UT/UT_StringMap.h>
 
 #include "gusd/defaultArray.h"
 #include "gusd/stageEdit.h"
@@ -50,6 +51,7 @@ typedef void (*GusdStageCacheReaderTracker)(bool addreader);
 
 class GusdUSD_DataCache;
 class UsdPrim;
+struct GusdUT_CacheStats;
 
 /// Cache for USD stages.
 /// Clients interact with the cache via the GusdStageCacheReader
@@ -101,6 +103,11 @@ public:
     void    RemoveDataCache(GusdUSD_DataCache& cache);
     /// @}
 
+    /// Get the usage statistics of the auxiliary data caches, keyed by
+    /// GusdUSD_DataCache::GetName(). Statistics of caches sharing a name
+    /// are summed.
+    void    GetDataCacheStats(UT_StringMap<GusdUT_CacheStats>& stats) const;
+
     /// \section GusdStageCache_Reloading Reloading
     ///
     /// Stages and layers may be reloaded during an active session, but it's
@@ -22,6 +22,7 @@
 // language governing permissions and limitations under the Apache License.
 //
 #include "gusd/stageCache.h"
+#include "gusd/UT_CappedCache.h"
 
 #include "pxr/base/tf/makePyConstructor.h"
 #include "pxr/base/tf/pyResultConversions.h"
@@ -210,6 +211,27 @@ _ReloadStages(GusdStageCache& self, const list& paths)
 }
 
 
+dict
+_GetDataCacheStats(GusdStageCache& self)
+{
+    UT_StringMap<GusdUT_CacheStats> stats;
+    self.GetDataCacheStats(stats);
+
+    dict result;
+    for(const auto& pair : stats) {
+        dict cacheStats;
+        cacheStats["entries"] = pair.second.entries;
+        cacheStats["memory"] = pair.second.memory;
+        cacheStats["hits"] = pair.second.hits;
+        cacheStats["misses"] = pair.second.misses;
+        cacheStats["evictions"] = pair.second.evictions;
+        cacheStats["computeTime"] = pair.second.computeTime;
+        result[pair.first.toStdString()] = cacheStats;
+    }
+    return result;
+}
+
+
 void wrapGusdStageCache()
 {
     using This = GusdStageCache;
@@ -257,5 +279,7 @@ void wrapGusdStageCache()
         .def("FindStages", &_FindStages, (arg("paths")))
 
         .def("ReloadStages", &_ReloadStages, (arg("paths")))
+
+        .def("GetDataCacheStats", &_GetDataCacheStats)
         ;
 }